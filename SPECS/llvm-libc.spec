@@ -1,19 +1,46 @@
 Name:           llvm-libc
 Version:        19.1.0
-Release:        1%{?dist}
+Release:        28%{?dist}
 Summary:        LLVM C standard library implementation
 
 License:        Apache License v2.0 with LLVM Exceptions
 URL:            https://libc.llvm.org/
 Source0:        llvm-libc-%{version}.tar.gz
 
+Patch0001:      0001-libc-Add-copy_file_range-splice-tee-and-zero-copy-fd-helpers.patch
+Patch0002:      0002-libc-Add-fmemopen-open_memstream-asprintf-and-vasprintf.patch
+Patch0003:      0003-libc-Make-mutex-and-rwlock-spinning-adaptive.patch
+Patch0004:      0004-libc-Add-priority-inheritance-mutexes.patch
+Patch0005:      0005-libc-Requeue-based-condition-variables-and-pthread_cond.patch
+Patch0006:      0006-libc-Add-queue-based-pthread-spin-locks-and-combining-tree-barriers.patch
+Patch0007:      0007-libc-Add-a-reader-biased-mode-to-RwLock.patch
+Patch0008:      0008-libc-Add-POSIX-semaphores.patch
+Patch0009:      0009-libc-Store-TSS-values-in-two-levels.patch
+Patch0010:      0010-libc-Cache-the-stacks-of-exited-threads.patch
+Patch0011:      0011-libc-Register-rseq-areas-and-add-sched_getcpu.patch
+Patch0012:      0012-libc-Add-lock-contention-profiling.patch
+Patch0013:      0013-libc-Add-futex_waitv-and-events-to-wait-for-any-of-several-words.patch
+Patch0014:      0014-libc-Add-a-bounded-MPMC-queue-and-an-eventcount.patch
+Patch0015:      0015-libc-Add-a-work-stealing-thread-pool.patch
+Patch0016:      0016-libc-add-slab-heap-with-thread-caches.patch
+Patch0017:      0017-libc-index-the-freelist-heap-with-tlsf.patch
+Patch0018:      0018-libc-add-growable-freelist-heap.patch
+Patch0019:      0019-libc-serve-small-freelist-heap-allocations-from-slabs.patch
+Patch0020:      0020-libc-grow-large-reallocs-in-place-or-by-remapping.patch
+Patch0021:      0021-libc-back-large-allocations-with-transparent-huge-pages.patch
+Patch0022:      0022-libc-add-posix_memalign.patch
+Patch0023:      0023-libc-add-malloc-statistics-and-a-sampling-heap-profiler.patch
+Patch0024:      0024-libc-add-a-region-allocator-with-arenas-built-on-block.patch
+Patch0025:      0025-libc-add-free_sized-and-free_aligned_sized.patch
+Patch0026:      0026-libc-keep-the-objects-of-the-slab-heap-on-their-numa-node.patch
+
 BuildRequires:  llvm, clang, cmake, python3-ninja 
 
 %description
 LLVM libc is an implementation of the C standard library optimized for use with LLVM and Clang. It aims to provide a fully compliant C17 library with better performance and more opportunities for whole-program optimization when used with LLVM-based compilers.
 
 %prep
-%setup -q
+%autosetup -p1
 %global debug_package %{nil}
 %build
 # 创建独立的构建目录build,需要在build内配置ninja
@@ -60,5 +87,87 @@ echo "Static library installed at /usr/local/lib/libllvmlibc.a and %{buildroot}/
 
 
 %changelog
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-28
+- Add per-NUMA-node arenas to the slab malloc
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-27
+- Add free_sized and free_aligned_sized and route sized deletes to them
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-26
+- Add an arena allocator extension API built on Block
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-25
+- Add mallinfo2, malloc_stats, malloc_usable_size and a sampling heap profiler
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-24
+- Add posix_memalign
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-23
+- Back large slab heap allocations with transparent huge pages
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-22
+- Grow large reallocs in place or by remapping their pages
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-21
+- Serve small allocations of FreeListHeap from slabs
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-20
+- Add a freelist heap that maps its memory on demand
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-19
+- Index the freelist heap with a two-level segregated fit
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-18
+- Add a slab heap with thread caches as the malloc of Linux full builds
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-17
+- Add a work-stealing thread pool with submit and parallel_for
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-16
+- Add a bounded lock-free MPMC queue and a futex eventcount
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-15
+- Add futex_waitv based waits on several futexes and C11-style events
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-14
+- Fix a narrowing conversion warning in TSS cleanup
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-13
+- Add opt-in lock contention profiling with snapshot and dump functions
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-12
+- Register rseq areas for all threads and add a fast sched_getcpu
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-11
+- Cache the stacks of exited threads for reuse by new threads
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-10
+- Store TSS values in two levels allocated on demand
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-9
+- Add POSIX semaphores with a userspace fast path
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-8
+- Add a reader-biased mode to pthread rwlocks
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-7
+- Add queue-based pthread spin locks and combining tree barriers
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-6
+- Rework condition variables around a sequence futex and add pthread_cond_*
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-5
+- Add priority inheritance mutexes and pthread_mutexattr_{get,set}protocol
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-4
+- Make mutex and rwlock spinning adapt to lock hold times
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-3
+- Add fmemopen, open_memstream, asprintf and vasprintf
+
+* Fri Oct 16 2026 westtide <tocokeo@outlook.com> - 19.1.0-2
+- Add copy_file_range, splice, tee and the __llvm_libc_copy_fd and
+  __llvm_libc_copy_file zero-copy helpers
+
 * Wed Sep 18 2024 westtide <tocokeo@outlook.com> - 19.1.0-1
 - Initial package of llvm-libc for openEuler